@@ -16,20 +16,20 @@
 @protocol ILSensorSinkTap <NSObject>
 
 /**
- Handles a message coming from the sensor sink.
+ Handles a message coming from the sensor sink. The return value will be used to determine if the message should be further processed by the sink or not. Returning NO also stops delivery of the message to any taps that have not been called yet; the order in which taps are called is undefined.
  
  @param s The sensor sink this message was sent to.
- @param channels A set of strings, the channels this message was sent to. (For more information, see ILSensorSink#logMessageWithContent:forChannels:.)
- @param content A JSON-like fragment, consisting of either a NSString, NSNumber, NSNull object, NSArray or NSDictionary. NSArrays will only contain objects of the aforementioned classes, whereas NSDictionaries will only contain objects of the aforementioned classes as values and NSStrings as keys.
+ @param messageContent A JSON-like fragment, consisting of either a NSString, NSNumber, NSNull object, NSArray or NSDictionary. NSArrays will only contain objects of the aforementioned classes, whereas NSDictionaries will only contain objects of the aforementioned classes as values and NSStrings as keys.
+ @param channels A set of strings, the channels this message was sent to. (For more information, see ILSensorSink#logMessageWithContent:onChannels:.)
  
- @return YES if you want to allow the sensor sink to further handle the message; NO if you have fully handled it. (In this version of Telemetry, the sensor sink's handling of a message prints a summary of that message to the console via NSLog.)
+ @return YES if you want to allow the sensor sink to further handle the message; NO if you have fully handled it. (In this version of Telemetry, the sensor sink's handling of a message prints a summary of that message to the console via NSLog.) If multiple taps are attached to a sink, any of them returning NO will prevent the message from being processed by the sink and by the remaining taps.
  */
-- (BOOL) sensorSink:(ILSensorSink*) s didReceiveMessageOnChannels:(NSSet*) channels withContent:(id) content;
+- (BOOL) sensorSink:(ILSensorSink*) s shouldProcessReceivedMessage:(id) messageContent postedOnChannels:(NSSet*) channels;
 
 @end
 
 /**
- Debug only: A sensor sink is the ultimate destination of all messages produced by telemetry-enabled classes. You can send messages to a sink manually, through utility macros (such as @ref ILLog and @ref ILLogDict), or handle logging messages yourself by setting a tap for this sensor sink (using the #tap property).
+ Debug only: A sensor sink is the ultimate destination of all messages produced by telemetry-enabled classes. You can send messages to a sink manually, through utility macros (such as @ref ILLog and @ref ILLogDict), or handle logging messages yourself by adding a tap to this sensor sink (using the #addTap: method).
  */
 @interface ILSensorSink : NSObject {}
 
@@ -42,7 +42,7 @@
  @param content The content of the message. This can be any object. The sensor sink will use this object to produce an informative JSON-like payload (consisting of NSArray, NSDictionary, NSString, NSNumber and NSNull objects only), using the NSObject#description and NSObject#descriptionForDebugging methods if needed.
  @param channels A set of strings, each of which is a channel upon which the message is being sent. Channels can be used to only display or handle messages coming from certain sources.
  */
-- (void) logMessageWithContent:(id) content forChannels:(NSSet*) channels;
+- (void) logMessageWithContent:(id) content onChannels:(NSSet*) channels;
 
 /**
  @private
@@ -57,9 +57,17 @@
 + (id) transferableObjectForObject:(id) object;
 
 /**
- Sets or retrieves the sensor tap for this sink. If non-nil, the tap will receive all messages before 
+ Indicates whether sending messages to the sink has any useful effect. If NO, you should avoid logging-related overhead.
+ 
+ This gates all handling of messages, taps included: a disabled sink discards every message it's sent without passing it to any tap. The default is NO.
  */
-@property(retain, nonatomic) id <ILSensorSinkTap> tap;
+@property(nonatomic, getter=isEnabled) BOOL enabled;
+
+/** Adds a sensor tap to the set of sensor taps for this sink. If the tap was already added to the set, nothing will happen. Each tap may receive messages sent while the sink is #enabled, before the sink handles them, unless another tap stops delivery first (see the ILSensorSinkTap protocol). */
+- (void) addTap:(id <ILSensorSinkTap>) tap;
+
+/** Removes a sensor tap from the set of sensor taps for this sink, if it was in that set. */
+- (void) removeTap:(id <ILSensorSinkTap>) tap;
 
 @end
 
@@ -78,9 +86,15 @@
 		[ILSensorSink log:([NSString stringWithFormat:(x) , ## __VA_ARGS__]) atLine:__LINE__ function:__PRETTY_FUNCTION__ object:(self) channel:(nil)]; \
 	} while (0)
 
-/** This macro expands to a nonzero value if you should expend processing time in producing logging, or zero if any logging-related processing can be skipped. In some releases of this library, this value may vary at runtime.
+/** Define this macro to 0 before importing this header to compile out all @ref ILLog and @ref ILLogDict calls in your own code; their arguments will not be evaluated. It defaults to 1.
+ */
+#ifndef ILShouldCompileLogging
+#define ILShouldCompileLogging (1)
+#endif
+
+/** This macro expands to a nonzero value if you should expend processing time in producing logging, or zero if any logging-related processing can be skipped. It's zero if logging is compiled out (see @ref ILShouldCompileLogging), and otherwise varies at runtime depending on whether the shared sink is enabled (see ILSensorSink#enabled).
  */
-#define ILShouldLog() (1)
+#define ILShouldLog() (ILShouldCompileLogging && [[ILSensorSink sharedSink] isEnabled])
 
 
 